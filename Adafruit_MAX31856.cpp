@@ -55,7 +55,8 @@
 Adafruit_MAX31856::Adafruit_MAX31856(int8_t spi_cs, int8_t spi_mosi,
                                      int8_t spi_miso, int8_t spi_clk)
     : spi_dev(spi_cs, spi_clk, spi_miso, spi_mosi, 1000000,
-              SPI_BITORDER_MSBFIRST, SPI_MODE1) {}
+              SPI_BITORDER_MSBFIRST, SPI_MODE1),
+      thermocouple_sensor(this), cold_junction_sensor(this) {}
 
 /**************************************************************************/
 /*!
@@ -65,17 +66,27 @@ Adafruit_MAX31856::Adafruit_MAX31856(int8_t spi_cs, int8_t spi_mosi,
 */
 /**************************************************************************/
 Adafruit_MAX31856::Adafruit_MAX31856(int8_t spi_cs, SPIClass *_spi)
-    : spi_dev(spi_cs, 1000000, SPI_BITORDER_MSBFIRST, SPI_MODE1, _spi) {}
+    : spi_dev(spi_cs, 1000000, SPI_BITORDER_MSBFIRST, SPI_MODE1, _spi),
+      thermocouple_sensor(this), cold_junction_sensor(this) {}
 
 /**************************************************************************/
 /*!
     @brief  Initialize MAX31856 attach/set pins or SPI device, default to K
    thermocouple
+    @param  sensor_id Unified sensor ID for the thermocouple, the cold
+   junction uses sensor_id + 1
     @returns Always returns true at this time (no known way of detecting chip
    ID)
 */
 /**************************************************************************/
-bool Adafruit_MAX31856::begin(void) {
+bool Adafruit_MAX31856::begin(int32_t sensor_id) {
+  _sensorid_thermocouple = sensor_id;
+  _sensorid_cold_junction = sensor_id + 1;
+
+  // the object may have been copied since construction (arrays, structs)
+  thermocouple_sensor = Adafruit_MAX31856_Thermocouple(this);
+  cold_junction_sensor = Adafruit_MAX31856_ColdJunction(this);
+
   initialized = spi_dev.begin();
 
   if (!initialized)
@@ -154,6 +165,35 @@ max31856_thermocoupletype_t Adafruit_MAX31856::getThermocoupleType(void) {
   return (max31856_thermocoupletype_t)(t);
 }
 
+/**************************************************************************/
+/*!
+    @brief  Set how many samples are averaged into each conversion result.
+    More averaging lowers noise but lengthens the conversion time.
+    @param averaging One of the max31856_averaging_t sample counts
+*/
+/**************************************************************************/
+void Adafruit_MAX31856::setAveragingMode(max31856_averaging_t averaging) {
+  uint8_t t = readRegister8(MAX31856_CR1_REG);
+  t &= 0x8F; // mask off averaging bits 6:4
+  t |= ((uint8_t)averaging & 0x07) << 4;
+  writeRegister8(MAX31856_CR1_REG, t);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Get how many samples are averaged into each conversion result
+    @returns The max31856_averaging_t sample count
+*/
+/**************************************************************************/
+max31856_averaging_t Adafruit_MAX31856::getAveragingMode(void) {
+  uint8_t t = readRegister8(MAX31856_CR1_REG);
+  t = (t >> 4) & 0x07;
+  if (t > MAX31856_AVERAGE_16)
+    t = MAX31856_AVERAGE_16; // 1xx all mean 16 samples
+
+  return (max31856_averaging_t)(t);
+}
+
 /**************************************************************************/
 /*!
     @brief  Read the fault register (8 bits)
@@ -164,6 +204,82 @@ uint8_t Adafruit_MAX31856::readFault(void) {
   return readRegister8(MAX31856_SR_REG);
 }
 
+/**************************************************************************/
+/*!
+    @brief  Read every register, CR0 through SR, in one burst. Useful for
+    diagnostics and checking that a chip is responding.
+    @param  buffer Where to store the MAX31856_REG_COUNT register values
+*/
+/**************************************************************************/
+void Adafruit_MAX31856::dumpRegisters(uint8_t *buffer) {
+  readRegisterN(MAX31856_CR0_REG, buffer, MAX31856_REG_COUNT);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Clear latched faults and release the FAULT pin. Only has an
+    effect in MAX31856_FAULTMODE_INTERRUPT mode.
+*/
+/**************************************************************************/
+void Adafruit_MAX31856::clearFault(void) {
+  uint8_t t = readRegister8(MAX31856_CR0_REG);
+  t |= MAX31856_CR0_FAULTCLR;
+  writeRegister8(MAX31856_CR0_REG, t);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Select which faults may assert the FAULT pin. A set bit masks
+    (ignores) that fault, using the same bits as the MAX31856_FAULT_ flags.
+    Faults are still reported by readFault() when masked.
+    @param  mask Bitwise OR of the MAX31856_FAULT_ flags to mask
+*/
+/**************************************************************************/
+void Adafruit_MAX31856::setFaultMask(uint8_t mask) {
+  writeRegister8(MAX31856_MASK_REG, mask);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Get which faults are masked from asserting the FAULT pin
+    @returns Bitwise OR of the masked MAX31856_FAULT_ flags
+*/
+/**************************************************************************/
+uint8_t Adafruit_MAX31856::getFaultMask(void) {
+  return readRegister8(MAX31856_MASK_REG);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Set whether the FAULT pin follows the fault condition
+    (comparator) or latches until clearFault() is called (interrupt)
+    @param  mode One of MAX31856_FAULTMODE_COMPARATOR or
+   MAX31856_FAULTMODE_INTERRUPT
+*/
+/**************************************************************************/
+void Adafruit_MAX31856::setFaultMode(max31856_fault_mode_t mode) {
+  uint8_t t = readRegister8(MAX31856_CR0_REG);
+  if (mode == MAX31856_FAULTMODE_INTERRUPT) {
+    t |= MAX31856_CR0_FAULT;
+  } else {
+    t &= ~MAX31856_CR0_FAULT;
+  }
+  writeRegister8(MAX31856_CR0_REG, t);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Get the FAULT pin mode
+    @returns One of MAX31856_FAULTMODE_COMPARATOR or
+   MAX31856_FAULTMODE_INTERRUPT
+*/
+/**************************************************************************/
+max31856_fault_mode_t Adafruit_MAX31856::getFaultMode(void) {
+  if (readRegister8(MAX31856_CR0_REG) & MAX31856_CR0_FAULT)
+    return MAX31856_FAULTMODE_INTERRUPT;
+  return MAX31856_FAULTMODE_COMPARATOR;
+}
+
 /**************************************************************************/
 /*!
     @brief  Sets the threshhold for internal chip temperature range
@@ -196,6 +312,18 @@ void Adafruit_MAX31856::setNoiseFilter(max31856_noise_filter_t noiseFilter) {
   writeRegister8(MAX31856_CR0_REG, t);
 }
 
+/**************************************************************************/
+/*!
+    @brief  Get the mains noise filter setting
+    @returns One of MAX31856_NOISE_FILTER_50HZ or MAX31856_NOISE_FILTER_60HZ
+*/
+/**************************************************************************/
+max31856_noise_filter_t Adafruit_MAX31856::getNoiseFilter(void) {
+  if (readRegister8(MAX31856_CR0_REG) & 0x01)
+    return MAX31856_NOISE_FILTER_50HZ;
+  return MAX31856_NOISE_FILTER_60HZ;
+}
+
 /**************************************************************************/
 /*!
     @brief  Sets the threshhold for thermocouple temperature range
@@ -220,6 +348,174 @@ void Adafruit_MAX31856::setTempFaultThreshholds(float flow, float fhigh) {
   writeRegister8(MAX31856_LTLFTL_REG, low);
 }
 
+/**************************************************************************/
+/*!
+    @brief  Gets the threshhold for thermocouple temperature range
+    for fault detection, as stored in the chip (0.0625 degree steps)
+    @param  flow Pointer to store the low (min) temperature
+    @param  fhigh Pointer to store the high (max) temperature
+*/
+/**************************************************************************/
+void Adafruit_MAX31856::getTempFaultThreshholds(float *flow, float *fhigh) {
+  // high MSB, high LSB, low MSB, low LSB
+  uint8_t buffer[4] = {0, 0, 0, 0};
+  readRegisterN(MAX31856_LTHFTH_REG, buffer, 4);
+
+  int16_t high = ((uint16_t)buffer[0] << 8) | buffer[1];
+  int16_t low = ((uint16_t)buffer[2] << 8) | buffer[3];
+
+  *fhigh = high / 16.0;
+  *flow = low / 16.0;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Stage a thermocouple type change. It is written to the chip
+    together with any other staged settings by applyStagedConfig(), or
+    right after the next readRaw() or readThermocoupleTemperature().
+    @param type The enumeration type of the thermocouple
+*/
+/**************************************************************************/
+void Adafruit_MAX31856::stageThermocoupleType(
+    max31856_thermocoupletype_t type) {
+  stageBits(MAX31856_CR1_REG, 0x0F, (uint8_t)type);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Stage an averaging change, see stageThermocoupleType()
+    @param averaging One of the max31856_averaging_t sample counts
+*/
+/**************************************************************************/
+void Adafruit_MAX31856::stageAveragingMode(max31856_averaging_t averaging) {
+  stageBits(MAX31856_CR1_REG, 0x70, (uint8_t)averaging << 4); // bits 6:4
+}
+
+/**************************************************************************/
+/*!
+    @brief  Stage a mains noise filter change, see stageThermocoupleType()
+    @param  noiseFilter One of MAX31856_NOISE_FILTER_50HZ or
+   MAX31856_NOISE_FILTER_60HZ
+*/
+/**************************************************************************/
+void Adafruit_MAX31856::stageNoiseFilter(max31856_noise_filter_t noiseFilter) {
+  stageBits(MAX31856_CR0_REG, 0x01,
+            noiseFilter == MAX31856_NOISE_FILTER_50HZ ? 0x01 : 0x00);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Stage new thermocouple fault thresholds, see
+    stageThermocoupleType(). Only threshold registers that differ from the
+    chip are written, and conversions carry on undisturbed.
+    @param  flow Low (min) temperature, floating point
+    @param  fhigh High (max) temperature, floating point
+*/
+/**************************************************************************/
+void Adafruit_MAX31856::stageTempFaultThreshholds(float flow, float fhigh) {
+  int16_t low = flow * 16;
+  int16_t high = fhigh * 16;
+
+  stageBits(MAX31856_LTHFTH_REG, 0xFF, high >> 8);
+  stageBits(MAX31856_LTHFTL_REG, 0xFF, high);
+  stageBits(MAX31856_LTLFTH_REG, 0xFF, low >> 8);
+  stageBits(MAX31856_LTLFTL_REG, 0xFF, low);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Stage a new fault mask, see stageThermocoupleType() and
+    setFaultMask()
+    @param  mask Bitwise OR of the MAX31856_FAULT_ flags to mask
+*/
+/**************************************************************************/
+void Adafruit_MAX31856::stageFaultMask(uint8_t mask) {
+  stageBits(MAX31856_MASK_REG, 0xFF, mask);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Check for staged settings that have not been written yet
+    @returns True if applyStagedConfig() still has something to write
+*/
+/**************************************************************************/
+bool Adafruit_MAX31856::stagedConfigPending(void) { return staged; }
+
+/**************************************************************************/
+/*!
+    @brief  Write staged settings to the chip. Only the staged fields are
+    merged into the registers read back from the chip, so settings made with
+    the set functions in the meantime are kept, unless the same field was
+    staged. The result is compared with the chip and only the span of
+    registers that changed is written, in one burst. Best called right after
+    DRDY or a completed read, so no conversion is cut in half. If the
+    conversion settings (CR0/CR1) change in continuous mode, conversions are
+    restarted so the next result is taken entirely with the new settings.
+    The first readRaw() sample taken with the new settings has its
+    reconfigured flag set. In continuous mode that is the first read at
+    least one conversion time after the write, and after a restart the
+    first conversion takes as long as a one-shot conversion. Sync reads to
+    DRDY to avoid reading the old result early.
+    @returns True if anything was written, false if nothing changed
+*/
+/**************************************************************************/
+bool Adafruit_MAX31856::applyStagedConfig(void) {
+  if (!staged)
+    return false;
+  staged = false;
+
+  uint8_t live[sizeof(stagedConfig)];
+  readRegisterN(MAX31856_CR0_REG, live, sizeof(live));
+  // don't re-trigger a one-shot or fault clear when written back
+  live[0] &= ~(MAX31856_CR0_1SHOT | MAX31856_CR0_FAULTCLR);
+
+  // merge the staged fields into the current registers
+  uint8_t config[sizeof(stagedConfig)];
+  for (uint8_t i = 0; i < sizeof(config); i++) {
+    config[i] = (live[i] & ~stagedBits[i]) | (stagedConfig[i] & stagedBits[i]);
+    stagedBits[i] = 0;
+  }
+
+  if (conversionMode == MAX31856_CONTINUOUS) {
+    config[0] |= MAX31856_CR0_AUTOCONVERT;
+  } else {
+    config[0] &= ~MAX31856_CR0_AUTOCONVERT;
+  }
+
+  // find the span of registers that changed
+  uint8_t first = 0, last = sizeof(config);
+  while (first < last && config[first] == live[first])
+    first++;
+  while (last > first && config[last - 1] == live[last - 1])
+    last--;
+  if (first == last)
+    return false;
+
+  bool restart =
+      first <= MAX31856_CR1_REG && conversionMode == MAX31856_CONTINUOUS;
+  if (restart) {
+    // the noise filter must only change while stopped, so stop with the
+    // live settings, write the new ones, then start again
+    writeRegister8(MAX31856_CR0_REG, live[0] & ~MAX31856_CR0_AUTOCONVERT);
+    config[0] &= ~MAX31856_CR0_AUTOCONVERT;
+    first = MAX31856_CR0_REG;
+  }
+  writeRegisterN(first, config + first, last - first);
+  if (restart) {
+    config[0] |= MAX31856_CR0_AUTOCONVERT;
+    writeRegister8(MAX31856_CR0_REG, config[0]);
+  }
+
+  // in continuous mode the first result with the new settings is only
+  // ready a full conversion after the write, and the first conversion
+  // after a restart is as slow as a one-shot
+  reconfiguredAt = millis();
+  if (conversionMode == MAX31856_CONTINUOUS)
+    reconfiguredAt += conversionTime(restart);
+  reconfigured = true;
+  return true;
+}
+
 /**************************************************************************/
 /*!
     @brief  Begin a one-shot (read temperature only upon request) measurement.
@@ -251,6 +547,45 @@ bool Adafruit_MAX31856::conversionComplete(void) {
   return !(readRegister8(MAX31856_CR0_REG) & MAX31856_CR0_1SHOT);
 }
 
+/**************************************************************************/
+/*!
+    @brief  Worst case time for one conversion with the current noise
+    filter, averaging and conversion mode, from the datasheet timing table.
+    @returns Conversion time in milliseconds
+*/
+/**************************************************************************/
+uint16_t Adafruit_MAX31856::getConversionTime(void) {
+  return conversionTime(conversionMode != MAX31856_CONTINUOUS);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Worst case conversion time for the current noise filter and
+    averaging
+    @param  first True for a one-shot or the first conversion after
+   auto-convert is turned on, false for the following continuous ones
+    @returns Conversion time in milliseconds
+*/
+/**************************************************************************/
+uint16_t Adafruit_MAX31856::conversionTime(bool first) {
+  // CR0 in the high byte, CR1 in the low byte
+  uint16_t cr = readRegister16(MAX31856_CR0_REG);
+  bool filter50 = cr & 0x0100;
+  uint8_t avgsel = (cr >> 4) & 0x07;
+  uint32_t extra = (1 << (avgsel > 4 ? 4 : avgsel)) - 1; // additional samples
+
+  if (!first) {
+    // 16.67ms (60hz) or 20ms (50hz) per additional sample
+    if (filter50)
+      return 110 + extra * 20;
+    return 90 + (extra * 50) / 3;
+  }
+  // 33.33ms (60hz) or 40ms (50hz) per additional sample
+  if (filter50)
+    return 185 + extra * 40;
+  return 155 + (extra * 100) / 3;
+}
+
 /**************************************************************************/
 /*!
     @brief  Return cold-junction (internal chip) temperature
@@ -259,7 +594,7 @@ bool Adafruit_MAX31856::conversionComplete(void) {
 /**************************************************************************/
 float Adafruit_MAX31856::readCJTemperature(void) {
 
-  return readRegister16(MAX31856_CJTH_REG) / 256.0;
+  return (int16_t)readRegister16(MAX31856_CJTH_REG) / 256.0;
 }
 
 /**************************************************************************/
@@ -271,15 +606,8 @@ float Adafruit_MAX31856::readCJTemperature(void) {
 float Adafruit_MAX31856::readThermocoupleTemperature(void) {
 
   // for one-shot, make it happen
-  if (conversionMode == MAX31856_ONESHOT) {
-    triggerOneShot();
-    uint32_t start = millis();
-    while (!conversionComplete()) {
-      if (millis() - start > 250)
-        return NAN;
-      delay(10);
-    }
-  }
+  if (!waitForOneShot())
+    return NAN;
 
   // read the thermocouple temperature registers (3 bytes)
   int32_t temp24 = readRegister24(MAX31856_LTCBH_REG);
@@ -290,11 +618,373 @@ float Adafruit_MAX31856::readThermocoupleTemperature(void) {
 
   temp24 >>= 5; // bottom 5 bits are unused
 
+  // there is nowhere to report it, but a boundary must not leak into a
+  // later readRaw()
+  consumeReconfigured();
+
+  // this is a conversion boundary, so staged settings can go in now
+  if (staged)
+    applyStagedConfig();
+
   return temp24 * 0.0078125;
 }
 
+/**************************************************************************/
+/*!
+    @brief  Read thermocouple, cold-junction and fault registers together
+    in one SPI transaction, without any floating point conversion. In
+    MAX31856_ONESHOT mode a conversion is triggered and waited for first.
+    @param  raw Pointer to the max31856_raw_t to fill in
+    @param  registers Optional buffer of MAX31856_RAW_BYTES to also receive
+   the undecoded CJTH through SR register bytes, for logging or replay
+    @returns True on success, false if a one-shot conversion timed out
+*/
+/**************************************************************************/
+bool Adafruit_MAX31856::readRaw(max31856_raw_t *raw, uint8_t *registers) {
+
+  if (!waitForOneShot())
+    return false;
+
+  // CJTH, CJTL, LTCBH, LTCBM, LTCBL, SR are consecutive registers
+  uint8_t buffer[MAX31856_RAW_BYTES] = {0, 0, 0, 0, 0, 0};
+  readRegisterN(MAX31856_CJTH_REG, buffer, MAX31856_RAW_BYTES);
+
+  decodeRaw(buffer, raw);
+  if (registers)
+    memcpy(registers, buffer, MAX31856_RAW_BYTES);
+
+  raw->reconfigured = consumeReconfigured();
+
+  // this is a conversion boundary, so staged settings can go in now
+  if (staged)
+    applyStagedConfig();
+
+  return true;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Decode register bytes as read by readRaw(), so that recorded
+    captures go through the same conversion as live readings
+    @param  registers The MAX31856_RAW_BYTES bytes from CJTH through SR
+    @param  raw Pointer to the max31856_raw_t to fill in, its reconfigured
+   flag is cleared
+*/
+/**************************************************************************/
+void Adafruit_MAX31856::decodeRaw(const uint8_t *registers,
+                                  max31856_raw_t *raw) {
+  raw->cold_junction = ((uint16_t)registers[0] << 8) | registers[1];
+
+  int32_t temp24 = ((uint32_t)registers[2] << 16) |
+                   ((uint16_t)registers[3] << 8) | registers[4];
+  if (temp24 & 0x800000) {
+    temp24 |= 0xFF000000; // fix sign
+  }
+  raw->thermocouple = temp24 >> 5; // bottom 5 bits are unused
+
+  raw->fault = registers[5];
+  raw->reconfigured = false;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Format a fixed point temperature as decimal text using only
+    integer math, no floating point, printf or heap. Rounds half away from
+    zero to the requested number of decimals, like Print::print(float).
+    @param  buffer Where to write the NUL terminated text
+    @param  len Size of buffer in bytes
+    @param  value Fixed point value, such as max31856_raw_t::thermocouple
+    @param  fractionBits Number of fraction bits in value, 7 for the
+   thermocouple (1/128 C) and 8 for the cold junction (1/256 C)
+    @param  decimals Digits after the decimal point, at most 7
+    @returns Number of characters written, or 0 if buffer is too small
+*/
+/**************************************************************************/
+uint8_t Adafruit_MAX31856::formatTemperature(char *buffer, uint8_t len,
+                                             int32_t value,
+                                             uint8_t fractionBits,
+                                             uint8_t decimals) {
+  if (decimals > 7)
+    decimals = 7;
+
+  uint32_t magnitude = (value < 0) ? -(uint32_t)value : value;
+  uint32_t whole = magnitude >> fractionBits;
+  uint32_t fraction = magnitude & ((1UL << fractionBits) - 1);
+
+  uint32_t scale = 1;
+  for (uint8_t i = 0; i < decimals; i++)
+    scale *= 10;
+
+  // round the fraction to the wanted number of decimals
+  if (fractionBits)
+    fraction = ((fraction * scale) + (1UL << (fractionBits - 1))) >>
+               fractionBits;
+  if (fraction >= scale) {
+    fraction -= scale;
+    whole++;
+  }
+
+  // build the digits backwards, fraction first
+  char digits[20];
+  uint8_t n = 0;
+  for (uint8_t i = 0; i < decimals; i++) {
+    digits[n++] = '0' + fraction % 10;
+    fraction /= 10;
+  }
+  if (decimals)
+    digits[n++] = '.';
+  do {
+    digits[n++] = '0' + whole % 10;
+    whole /= 10;
+  } while (whole);
+  if (value < 0)
+    digits[n++] = '-';
+
+  if (n >= len)
+    return 0;
+
+  for (uint8_t i = 0; i < n; i++)
+    buffer[i] = digits[n - 1 - i];
+  buffer[n] = 0;
+
+  return n;
+}
+
+// append a string to buffer at *pos, false if it does not fit
+static bool appendString(char *buffer, uint8_t len, uint8_t *pos,
+                         const char *str) {
+  while (*str) {
+    if (*pos + 1 >= len)
+      return false;
+    buffer[(*pos)++] = *str++;
+  }
+  buffer[*pos] = 0;
+  return true;
+}
+
+// append a fixed point value to buffer at *pos, false if it does not fit
+static bool appendNumber(char *buffer, uint8_t len, uint8_t *pos,
+                         int32_t value, uint8_t fractionBits,
+                         uint8_t decimals) {
+  uint8_t n = Adafruit_MAX31856::formatTemperature(
+      buffer + *pos, len - *pos, value, fractionBits, decimals);
+  *pos += n;
+  return n != 0;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Format a raw sample as a CSV line, "thermocouple,cold_junction,
+    fault", without floating point, printf or heap
+    @param  buffer Where to write the NUL terminated text
+    @param  len Size of buffer in bytes, 32 is always enough
+    @param  raw The sample, as filled in by readRaw()
+    @param  decimals Digits after the decimal point, at most 7
+    @returns Number of characters written, or 0 if buffer is too small
+*/
+/**************************************************************************/
+uint8_t Adafruit_MAX31856::formatCSV(char *buffer, uint8_t len,
+                                     const max31856_raw_t *raw,
+                                     uint8_t decimals) {
+  uint8_t pos = 0;
+
+  if (appendNumber(buffer, len, &pos, raw->thermocouple, 7, decimals) &&
+      appendString(buffer, len, &pos, ",") &&
+      appendNumber(buffer, len, &pos, raw->cold_junction, 8, decimals) &&
+      appendString(buffer, len, &pos, ",") &&
+      appendNumber(buffer, len, &pos, raw->fault, 0, 0))
+    return pos;
+
+  if (len)
+    buffer[0] = 0;
+  return 0;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Format a raw sample as a JSON object, {"tc":..,"cj":..,
+    "fault":..}, without floating point, printf or heap
+    @param  buffer Where to write the NUL terminated text
+    @param  len Size of buffer in bytes, 64 is always enough
+    @param  raw The sample, as filled in by readRaw()
+    @param  decimals Digits after the decimal point, at most 7
+    @returns Number of characters written, or 0 if buffer is too small
+*/
+/**************************************************************************/
+uint8_t Adafruit_MAX31856::formatJSON(char *buffer, uint8_t len,
+                                      const max31856_raw_t *raw,
+                                      uint8_t decimals) {
+  uint8_t pos = 0;
+
+  if (appendString(buffer, len, &pos, "{\"tc\":") &&
+      appendNumber(buffer, len, &pos, raw->thermocouple, 7, decimals) &&
+      appendString(buffer, len, &pos, ",\"cj\":") &&
+      appendNumber(buffer, len, &pos, raw->cold_junction, 8, decimals) &&
+      appendString(buffer, len, &pos, ",\"fault\":") &&
+      appendNumber(buffer, len, &pos, raw->fault, 0, 0) &&
+      appendString(buffer, len, &pos, "}"))
+    return pos;
+
+  if (len)
+    buffer[0] = 0;
+  return 0;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Gets the thermocouple and cold junction temperatures as
+    Adafruit Unified Sensor events, both from a single burst read.
+    @param  thermocouple Sensor event to fill with the thermocouple
+   temperature, or NULL to skip it
+    @param  cold_junction Sensor event to fill with the cold junction
+   temperature, or NULL to skip it
+    @returns True on success, false if a one-shot conversion timed out
+*/
+/**************************************************************************/
+bool Adafruit_MAX31856::getEvent(sensors_event_t *thermocouple,
+                                 sensors_event_t *cold_junction) {
+  max31856_raw_t raw;
+  if (!readRaw(&raw))
+    return false;
+
+  uint32_t t = millis();
+
+  if (thermocouple) {
+    memset(thermocouple, 0, sizeof(sensors_event_t));
+    thermocouple->version = sizeof(sensors_event_t);
+    thermocouple->sensor_id = _sensorid_thermocouple;
+    thermocouple->type = SENSOR_TYPE_OBJECT_TEMPERATURE;
+    thermocouple->timestamp = t;
+    thermocouple->temperature = raw.thermocouple * 0.0078125;
+  }
+
+  if (cold_junction) {
+    memset(cold_junction, 0, sizeof(sensors_event_t));
+    cold_junction->version = sizeof(sensors_event_t);
+    cold_junction->sensor_id = _sensorid_cold_junction;
+    cold_junction->type = SENSOR_TYPE_AMBIENT_TEMPERATURE;
+    cold_junction->timestamp = t;
+    cold_junction->temperature = raw.cold_junction / 256.0;
+  }
+
+  return true;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Gets an Adafruit Unified Sensor object for the thermocouple
+    @returns Adafruit_Sensor pointer to the thermocouple sensor
+*/
+/**************************************************************************/
+Adafruit_Sensor *Adafruit_MAX31856::getThermocoupleSensor(void) {
+  return &thermocouple_sensor;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Gets an Adafruit Unified Sensor object for the cold junction
+    @returns Adafruit_Sensor pointer to the cold junction sensor
+*/
+/**************************************************************************/
+Adafruit_Sensor *Adafruit_MAX31856::getColdJunctionSensor(void) {
+  return &cold_junction_sensor;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Gets the sensor_t data for the thermocouple
+    @param  sensor Pointer to the sensor_t to fill in
+*/
+/**************************************************************************/
+void Adafruit_MAX31856_Thermocouple::getSensor(sensor_t *sensor) {
+  memset(sensor, 0, sizeof(sensor_t));
+
+  strncpy(sensor->name, "MAX31856", sizeof(sensor->name) - 1);
+  sensor->name[sizeof(sensor->name) - 1] = 0;
+  sensor->version = 1;
+  sensor->sensor_id = _theMAX31856->_sensorid_thermocouple;
+  sensor->type = SENSOR_TYPE_OBJECT_TEMPERATURE;
+  sensor->min_delay = 0;
+  sensor->min_value = -210;
+  sensor->max_value = 1800;
+  sensor->resolution = 0.0078125;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Gets the thermocouple temperature as a standard sensor event
+    @param  event Sensor event object that will be populated
+    @returns True on success, false if a one-shot conversion timed out
+*/
+/**************************************************************************/
+bool Adafruit_MAX31856_Thermocouple::getEvent(sensors_event_t *event) {
+  return _theMAX31856->getEvent(event, NULL);
+}
+
+/**************************************************************************/
+/*!
+    @brief  Gets the sensor_t data for the cold junction
+    @param  sensor Pointer to the sensor_t to fill in
+*/
+/**************************************************************************/
+void Adafruit_MAX31856_ColdJunction::getSensor(sensor_t *sensor) {
+  memset(sensor, 0, sizeof(sensor_t));
+
+  strncpy(sensor->name, "MAX31856", sizeof(sensor->name) - 1);
+  sensor->name[sizeof(sensor->name) - 1] = 0;
+  sensor->version = 1;
+  sensor->sensor_id = _theMAX31856->_sensorid_cold_junction;
+  sensor->type = SENSOR_TYPE_AMBIENT_TEMPERATURE;
+  sensor->min_delay = 0;
+  sensor->min_value = -55;
+  sensor->max_value = 125;
+  sensor->resolution = 0.015625;
+}
+
+/**************************************************************************/
+/*!
+    @brief  Gets the cold junction temperature as a standard sensor event
+    @param  event Sensor event object that will be populated
+    @returns True on success, false if a one-shot conversion timed out
+*/
+/**************************************************************************/
+bool Adafruit_MAX31856_ColdJunction::getEvent(sensors_event_t *event) {
+  return _theMAX31856->getEvent(NULL, event);
+}
+
 /**********************************************/
 
+void Adafruit_MAX31856::stageBits(uint8_t reg, uint8_t bits, uint8_t value) {
+  stagedConfig[reg] = (stagedConfig[reg] & ~bits) | (value & bits);
+  stagedBits[reg] |= bits;
+  staged = true;
+}
+
+bool Adafruit_MAX31856::consumeReconfigured(void) {
+  if (!reconfigured)
+    return false;
+  // a read before the first new conversion finished still has old data
+  if ((int32_t)(millis() - reconfiguredAt) < 0)
+    return false;
+  reconfigured = false;
+  return true;
+}
+
+bool Adafruit_MAX31856::waitForOneShot(void) {
+  if (conversionMode != MAX31856_ONESHOT)
+    return true;
+
+  uint16_t timeout = getConversionTime() + 100;
+  triggerOneShot();
+  uint32_t start = millis();
+  while (!conversionComplete()) {
+    if (millis() - start > timeout)
+      return false;
+    delay(10);
+  }
+  return true;
+}
+
 uint8_t Adafruit_MAX31856::readRegister8(uint8_t addr) {
   uint8_t ret = 0;
   readRegisterN(addr, &ret, 1);
@@ -340,3 +1030,11 @@ void Adafruit_MAX31856::writeRegister8(uint8_t addr, uint8_t data) {
 
   spi_dev.write(buffer, 2);
 }
+
+void Adafruit_MAX31856::writeRegisterN(uint8_t addr, const uint8_t buffer[],
+                                       uint8_t n) {
+  addr |= 0x80; // MSB=1 for write, make sure top bit is set
+
+  // the address auto-increments, so this is one burst transaction
+  spi_dev.write(buffer, n, &addr, 1);
+}
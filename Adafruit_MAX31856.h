@@ -50,6 +50,9 @@
 #define MAX31856_LTCBL_REG 0x0E ///< Linearized TC Temperature, Byte 0
 #define MAX31856_SR_REG 0x0F    ///< Fault Status Register
 
+#define MAX31856_RAW_BYTES 6  ///< Register bytes read by readRaw(), CJTH-SR
+#define MAX31856_REG_COUNT 16 ///< Number of registers, CR0 through SR
+
 #define MAX31856_FAULT_CJRANGE                                                 \
   0x80 ///< Fault status Cold Junction Out-of-Range flag
 #define MAX31856_FAULT_TCRANGE                                                 \
@@ -72,6 +75,21 @@ typedef enum {
   MAX31856_NOISE_FILTER_60HZ
 } max31856_noise_filter_t;
 
+/** Number of samples averaged per conversion. Use with setAveragingMode() */
+typedef enum {
+  MAX31856_AVERAGE_1 = 0b000,
+  MAX31856_AVERAGE_2 = 0b001,
+  MAX31856_AVERAGE_4 = 0b010,
+  MAX31856_AVERAGE_8 = 0b011,
+  MAX31856_AVERAGE_16 = 0b100,
+} max31856_averaging_t;
+
+/** FAULT output behaviour. Use with setFaultMode() */
+typedef enum {
+  MAX31856_FAULTMODE_COMPARATOR,
+  MAX31856_FAULTMODE_INTERRUPT
+} max31856_fault_mode_t;
+
 /** Multiple types of thermocouples supported */
 typedef enum {
   MAX31856_TCTYPE_B = 0b0000,
@@ -100,6 +118,47 @@ typedef enum {
 #endif
 
 #include <Adafruit_SPIDevice.h>
+#include <Adafruit_Sensor.h>
+
+/** Raw conversion result, read in a single burst by readRaw() */
+typedef struct {
+  int32_t thermocouple;  ///< Thermocouple temperature in 1/128 degrees C
+  int16_t cold_junction; ///< Cold junction temperature in 1/256 degrees C
+  uint8_t fault;         ///< Fault status register, MAX31856_FAULT_ flags
+  bool reconfigured;     ///< First sample after staged config was applied
+} max31856_raw_t;
+
+class Adafruit_MAX31856;
+
+/** Adafruit Unified Sensor interface for the thermocouple temperature */
+class Adafruit_MAX31856_Thermocouple : public Adafruit_Sensor {
+public:
+  /** @brief Create an Adafruit_Sensor compatible object for the thermocouple
+      @param parent A pointer to the MAX31856 class */
+  Adafruit_MAX31856_Thermocouple(Adafruit_MAX31856 *parent) {
+    _theMAX31856 = parent;
+  }
+  bool getEvent(sensors_event_t *);
+  void getSensor(sensor_t *);
+
+private:
+  Adafruit_MAX31856 *_theMAX31856 = NULL;
+};
+
+/** Adafruit Unified Sensor interface for the cold junction temperature */
+class Adafruit_MAX31856_ColdJunction : public Adafruit_Sensor {
+public:
+  /** @brief Create an Adafruit_Sensor compatible object for the cold junction
+      @param parent A pointer to the MAX31856 class */
+  Adafruit_MAX31856_ColdJunction(Adafruit_MAX31856 *parent) {
+    _theMAX31856 = parent;
+  }
+  bool getEvent(sensors_event_t *);
+  void getSensor(sensor_t *);
+
+private:
+  Adafruit_MAX31856 *_theMAX31856 = NULL;
+};
 
 /**************************************************************************/
 /*!
@@ -113,7 +172,7 @@ public:
                     int8_t spi_clk);
   Adafruit_MAX31856(int8_t spi_cs, SPIClass *_spi = &SPI);
 
-  bool begin(void);
+  bool begin(int32_t sensor_id = 0);
 
   void setConversionMode(max31856_conversion_mode_t mode);
   max31856_conversion_mode_t getConversionMode(void);
@@ -121,17 +180,51 @@ public:
   void setThermocoupleType(max31856_thermocoupletype_t type);
   max31856_thermocoupletype_t getThermocoupleType(void);
 
+  void setAveragingMode(max31856_averaging_t averaging);
+  max31856_averaging_t getAveragingMode(void);
+
   uint8_t readFault(void);
+  void dumpRegisters(uint8_t *buffer);
+  void clearFault(void);
+
+  void setFaultMask(uint8_t mask);
+  uint8_t getFaultMask(void);
+  void setFaultMode(max31856_fault_mode_t mode);
+  max31856_fault_mode_t getFaultMode(void);
 
   void triggerOneShot(void);
   bool conversionComplete(void);
+  uint16_t getConversionTime(void);
 
   float readCJTemperature(void);
   float readThermocoupleTemperature(void);
+  bool readRaw(max31856_raw_t *raw, uint8_t *registers = NULL);
+  static void decodeRaw(const uint8_t *registers, max31856_raw_t *raw);
+
+  static uint8_t formatTemperature(char *buffer, uint8_t len, int32_t value,
+                                   uint8_t fractionBits, uint8_t decimals);
+  static uint8_t formatCSV(char *buffer, uint8_t len, const max31856_raw_t *raw,
+                           uint8_t decimals = 2);
+  static uint8_t formatJSON(char *buffer, uint8_t len,
+                            const max31856_raw_t *raw, uint8_t decimals = 2);
+
+  bool getEvent(sensors_event_t *thermocouple, sensors_event_t *cold_junction);
+  Adafruit_Sensor *getThermocoupleSensor(void);
+  Adafruit_Sensor *getColdJunctionSensor(void);
 
   void setTempFaultThreshholds(float flow, float fhigh);
+  void getTempFaultThreshholds(float *flow, float *fhigh);
   void setColdJunctionFaultThreshholds(int8_t low, int8_t high);
   void setNoiseFilter(max31856_noise_filter_t noiseFilter);
+  max31856_noise_filter_t getNoiseFilter(void);
+
+  void stageThermocoupleType(max31856_thermocoupletype_t type);
+  void stageAveragingMode(max31856_averaging_t averaging);
+  void stageNoiseFilter(max31856_noise_filter_t noiseFilter);
+  void stageTempFaultThreshholds(float flow, float fhigh);
+  void stageFaultMask(uint8_t mask);
+  bool stagedConfigPending(void);
+  bool applyStagedConfig(void);
 
 private:
   Adafruit_SPIDevice spi_dev;
@@ -139,6 +232,26 @@ private:
 
   max31856_conversion_mode_t conversionMode;
 
+  // CR0 through LTLFTL, indexed by register address
+  uint8_t stagedConfig[MAX31856_LTLFTL_REG + 1];     // staged values
+  uint8_t stagedBits[MAX31856_LTLFTL_REG + 1] = {0}; // which bits are staged
+  bool staged = false;
+  bool reconfigured = false;
+  uint32_t reconfiguredAt = 0; // millis() when new settings give results
+
+  Adafruit_MAX31856_Thermocouple thermocouple_sensor;
+  Adafruit_MAX31856_ColdJunction cold_junction_sensor;
+  int32_t _sensorid_thermocouple = 0;
+  int32_t _sensorid_cold_junction = 1;
+
+  friend class Adafruit_MAX31856_Thermocouple;
+  friend class Adafruit_MAX31856_ColdJunction;
+
+  bool waitForOneShot(void);
+  uint16_t conversionTime(bool first);
+  bool consumeReconfigured(void);
+  void stageBits(uint8_t reg, uint8_t bits, uint8_t value);
+
   void readRegisterN(uint8_t addr, uint8_t buffer[], uint8_t n);
 
   uint8_t readRegister8(uint8_t addr);
@@ -146,6 +259,7 @@ private:
   uint32_t readRegister24(uint8_t addr);
 
   void writeRegister8(uint8_t addr, uint8_t reg);
+  void writeRegisterN(uint8_t addr, const uint8_t buffer[], uint8_t n);
 };
 
 #endif
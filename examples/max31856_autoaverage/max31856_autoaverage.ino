@@ -0,0 +1,132 @@
+// This example picks the fastest noise filter and averaging setting
+// that still meets a noise target. Each candidate setting is tried on
+// live readings, and the quickest one whose RMS noise is below the
+// target (and whose conversion time fits the latency limit) is kept.
+// The noise is re-checked every so often, and the search is run again
+// if the electrical environment changes.
+
+#include <Adafruit_MAX31856.h>
+
+#define NOISE_TARGET 0.05     // RMS noise target, degrees C
+#define MAX_LATENCY 500       // longest acceptable conversion, milliseconds
+#define NOISE_SAMPLES 16      // readings used for each noise measurement
+#define RECHECK_INTERVAL 60000 // how often to re-check noise, milliseconds
+
+// Use software SPI: CS, DI, DO, CLK
+//Adafruit_MAX31856 maxthermo = Adafruit_MAX31856(10, 11, 12, 13);
+// use hardware SPI, just pass in the CS pin
+Adafruit_MAX31856 maxthermo = Adafruit_MAX31856(10);
+
+const max31856_averaging_t averages[] = {
+  MAX31856_AVERAGE_1, MAX31856_AVERAGE_2, MAX31856_AVERAGE_4,
+  MAX31856_AVERAGE_8, MAX31856_AVERAGE_16
+};
+const max31856_noise_filter_t filters[] = {
+  MAX31856_NOISE_FILTER_60HZ, MAX31856_NOISE_FILTER_50HZ
+};
+
+uint32_t lastCheck = 0;
+
+// RMS deviation from the mean of a few live readings. The sums are kept
+// as offsets from the first reading in raw 1/128 degree codes, so they
+// stay small and exact even at high process temperatures.
+float measureNoise() {
+  max31856_raw_t raw;
+  int32_t first = 0;
+  float sum = 0, sumsq = 0;
+  for (int i = 0; i < NOISE_SAMPLES; i++) {
+    if (!maxthermo.readRaw(&raw)) return NAN;
+    if (i == 0) first = raw.thermocouple;
+    float d = raw.thermocouple - first;
+    sum += d;
+    sumsq += d * d;
+  }
+  float mean = sum / NOISE_SAMPLES;
+  float var = sumsq / NOISE_SAMPLES - mean * mean;
+  return var > 0 ? sqrt(var) / 128 : 0;
+}
+
+void optimize() {
+  max31856_noise_filter_t bestFilter = MAX31856_NOISE_FILTER_60HZ;
+  max31856_averaging_t bestAverage = MAX31856_AVERAGE_1;
+  uint16_t bestTime = 0xFFFF;
+  // fallback if nothing meets the target: quietest setting within latency
+  max31856_noise_filter_t quietFilter = MAX31856_NOISE_FILTER_60HZ;
+  max31856_averaging_t quietAverage = MAX31856_AVERAGE_1;
+  float quietNoise = NAN;
+
+  Serial.println("Searching for fastest setting...");
+  for (uint8_t f = 0; f < sizeof(filters) / sizeof(filters[0]); f++) {
+    // averages are tried fastest first, so stop at the first one that passes
+    for (uint8_t a = 0; a < sizeof(averages) / sizeof(averages[0]); a++) {
+      maxthermo.setNoiseFilter(filters[f]);
+      maxthermo.setAveragingMode(averages[a]);
+      uint16_t time = maxthermo.getConversionTime();
+      if (time > MAX_LATENCY || time >= bestTime) break;
+
+      float noise = measureNoise();
+      Serial.print("  filter ");
+      Serial.print(filters[f] == MAX31856_NOISE_FILTER_50HZ ? "50Hz" : "60Hz");
+      Serial.print(", average ");
+      Serial.print(1 << averages[a]);
+      Serial.print(": ");
+      Serial.print(time);
+      Serial.print(" ms, noise ");
+      Serial.println(noise, 4);
+
+      if (!isnan(noise) && (isnan(quietNoise) || noise < quietNoise)) {
+        quietFilter = filters[f];
+        quietAverage = averages[a];
+        quietNoise = noise;
+      }
+      if (!isnan(noise) && noise <= NOISE_TARGET) {
+        bestFilter = filters[f];
+        bestAverage = averages[a];
+        bestTime = time;
+        break;
+      }
+    }
+  }
+
+  if (bestTime == 0xFFFF) {
+    Serial.println("No setting meets the target, using the quietest one");
+    bestFilter = quietFilter;
+    bestAverage = quietAverage;
+  }
+  maxthermo.setNoiseFilter(bestFilter);
+  maxthermo.setAveragingMode(bestAverage);
+  Serial.print("Using ");
+  Serial.print(maxthermo.getConversionTime());
+  Serial.println(" ms conversions");
+  lastCheck = millis();
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial) delay(10);
+  Serial.println("MAX31856 automatic averaging test");
+
+  if (!maxthermo.begin()) {
+    Serial.println("Could not initialize thermocouple.");
+    while (1) delay(10);
+  }
+
+  maxthermo.setThermocoupleType(MAX31856_TCTYPE_K);
+
+  optimize();
+}
+
+void loop() {
+  if (millis() - lastCheck > RECHECK_INTERVAL) {
+    lastCheck = millis();
+    float noise = measureNoise();
+    // re-run the search if we are now too noisy, or quiet enough to speed up
+    if (isnan(noise) || noise > NOISE_TARGET ||
+        (noise < NOISE_TARGET / 4 &&
+         maxthermo.getAveragingMode() != MAX31856_AVERAGE_1)) {
+      optimize();
+    }
+  }
+
+  Serial.println(maxthermo.readThermocoupleTemperature());
+}
@@ -0,0 +1,55 @@
+// This example records raw register captures for offline analysis.
+// Each line holds the millis() timestamp and the 6 undecoded register
+// bytes (CJTH, CJTL, LTCBH, LTCBM, LTCBL, SR) in hex, for example:
+//
+//   12345,19A0007D4000
+//
+// Captures can later be fed through Adafruit_MAX31856::decodeRaw(), the
+// same decode that live readings use, to try out averaging, decimation
+// or alarm settings on real field data, for example with the
+// max31856_replay example. Reads are synced to DRDY so that every
+// conversion is captured exactly once.
+
+#include <Adafruit_MAX31856.h>
+
+#define DRDY_PIN 5
+
+// Use software SPI: CS, DI, DO, CLK
+//Adafruit_MAX31856 maxthermo = Adafruit_MAX31856(10, 11, 12, 13);
+// use hardware SPI, just pass in the CS pin
+Adafruit_MAX31856 maxthermo = Adafruit_MAX31856(10);
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial) delay(10);
+  Serial.println("# MAX31856 raw capture");
+
+  pinMode(DRDY_PIN, INPUT);
+
+  if (!maxthermo.begin()) {
+    Serial.println("# Could not initialize thermocouple.");
+    while (1) delay(10);
+  }
+
+  maxthermo.setThermocoupleType(MAX31856_TCTYPE_K);
+  maxthermo.setConversionMode(MAX31856_CONTINUOUS);
+}
+
+void loop() {
+  max31856_raw_t raw;
+  uint8_t registers[MAX31856_RAW_BYTES];
+
+  // The DRDY output goes low when a new conversion result is available
+  while (digitalRead(DRDY_PIN)) delay(1);
+
+  uint32_t now = millis();
+  maxthermo.readRaw(&raw, registers);
+
+  Serial.print(now);
+  Serial.print(',');
+  for (uint8_t i = 0; i < MAX31856_RAW_BYTES; i++) {
+    if (registers[i] < 0x10) Serial.print('0');
+    Serial.print(registers[i], HEX);
+  }
+  Serial.println();
+}
@@ -0,0 +1,120 @@
+// This example keeps a channel map (thermocouple type, noise filter and
+// high temperature limit per chip) that can be changed while acquisition
+// keeps running. Send a line like
+//
+//   2,J,50,300
+//
+// to set channel 2 to a type J thermocouple, 50Hz filter and a 300 degree
+// limit. The new settings are staged and written right after that chip's
+// next reading, and only registers that actually changed are written, so
+// no other chip sees any bus traffic and no reading is lost.
+
+#include <Adafruit_MAX31856.h>
+
+#define NUM_THERMO 4
+
+struct ChannelConfig {
+  max31856_thermocoupletype_t type;
+  max31856_noise_filter_t filter;
+  int16_t limit; // high fault threshold, degrees C
+};
+
+// use hardware SPI, just pass in the CS pin of each chip
+Adafruit_MAX31856 maxthermo[NUM_THERMO] = {
+  Adafruit_MAX31856(10),
+  Adafruit_MAX31856(9),
+  Adafruit_MAX31856(8),
+  Adafruit_MAX31856(7),
+};
+
+ChannelConfig channelMap[NUM_THERMO] = {
+  {MAX31856_TCTYPE_K, MAX31856_NOISE_FILTER_60HZ, 250},
+  {MAX31856_TCTYPE_K, MAX31856_NOISE_FILTER_60HZ, 250},
+  {MAX31856_TCTYPE_K, MAX31856_NOISE_FILTER_60HZ, 250},
+  {MAX31856_TCTYPE_K, MAX31856_NOISE_FILTER_60HZ, 250},
+};
+
+const char typeLetters[] = "BEJKNRST"; // in max31856_thermocoupletype_t order
+
+char command[32];
+uint8_t commandLen = 0;
+uint32_t lastRead = 0;
+
+void stageChannel(int i) {
+  maxthermo[i].stageThermocoupleType(channelMap[i].type);
+  maxthermo[i].stageNoiseFilter(channelMap[i].filter);
+  maxthermo[i].stageTempFaultThreshholds(-250, channelMap[i].limit);
+}
+
+// parse "channel,type,filter,limit" into the channel map
+void handleCommand() {
+  char *fields[4];
+  uint8_t n = 0;
+  char *p = strtok(command, ",");
+  while (p && n < 4) {
+    fields[n++] = p;
+    p = strtok(NULL, ",");
+  }
+  if (n != 4) {
+    Serial.println("Expected: channel,type,filter,limit");
+    return;
+  }
+
+  int ch = atoi(fields[0]);
+  const char *letter = strchr(typeLetters, fields[1][0]);
+  int filter = atoi(fields[2]);
+  if (ch < 0 || ch >= NUM_THERMO || !letter || !fields[1][0] ||
+      (filter != 50 && filter != 60)) {
+    Serial.println("Bad channel, type or filter");
+    return;
+  }
+
+  channelMap[ch].type = (max31856_thermocoupletype_t)(letter - typeLetters);
+  channelMap[ch].filter = (filter == 50) ? MAX31856_NOISE_FILTER_50HZ
+                                         : MAX31856_NOISE_FILTER_60HZ;
+  channelMap[ch].limit = atoi(fields[3]);
+  stageChannel(ch);
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial) delay(10);
+  Serial.println("MAX31856 live channel map test");
+
+  for (int i = 0; i < NUM_THERMO; i++) {
+    if (!maxthermo[i].begin()) {
+      Serial.print("Could not initialize thermocouple #");
+      Serial.println(i);
+      while (1) delay(10);
+    }
+    maxthermo[i].setConversionMode(MAX31856_CONTINUOUS);
+    stageChannel(i);
+    maxthermo[i].applyStagedConfig();
+  }
+}
+
+void loop() {
+  while (Serial.available()) {
+    char c = Serial.read();
+    if (c == '\n' || c == '\r') {
+      if (commandLen) {
+        command[commandLen] = 0;
+        handleCommand();
+        commandLen = 0;
+      }
+    } else if (commandLen < sizeof(command) - 1) {
+      command[commandLen++] = c;
+    }
+  }
+
+  if (millis() - lastRead < 1000) return;
+  lastRead = millis();
+
+  for (int i = 0; i < NUM_THERMO; i++) {
+    max31856_raw_t raw;
+    maxthermo[i].readRaw(&raw); // staged changes are written after this
+    Serial.print(raw.thermocouple / 128.0);
+    Serial.print(raw.reconfigured ? "* " : "  ");
+  }
+  Serial.println(); // * marks the first reading with new settings
+}
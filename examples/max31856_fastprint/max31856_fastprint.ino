@@ -0,0 +1,123 @@
+// This example prints readings as CSV or JSON lines without any floating
+// point math. The raw 1/128 and 1/256 degree codes from readRaw() are
+// turned into decimal text with integer math only, into a buffer we
+// provide, which is much quicker than printing floats on small chips.
+//
+// Uncomment RUN_SELF_TEST to check the integer formatter against the
+// float printing path at startup. It takes a few seconds on small chips.
+
+#include <Adafruit_MAX31856.h>
+
+#define DECIMALS 2
+//#define RUN_SELF_TEST
+
+// Use software SPI: CS, DI, DO, CLK
+//Adafruit_MAX31856 maxthermo = Adafruit_MAX31856(10, 11, 12, 13);
+// use hardware SPI, just pass in the CS pin
+Adafruit_MAX31856 maxthermo = Adafruit_MAX31856(10);
+
+char line[64];
+
+// The self test is always compiled, so it keeps building with the library,
+// and only runs when RUN_SELF_TEST is defined.
+
+// exact ties (like 0.125 to 2 decimals) may round either way in float
+bool isTie(int32_t code, uint8_t fractionBits) {
+  uint32_t magnitude = code < 0 ? -code : code;
+  uint32_t scaled = magnitude & ((1UL << fractionBits) - 1);
+  for (uint8_t i = 0; i < DECIMALS; i++) scaled *= 10;
+  return (scaled & ((1UL << fractionBits) - 1)) == (1UL << (fractionBits - 1));
+}
+
+// compare against float printing for a sample of codes across a range
+uint32_t checkRange(int32_t from, int32_t to, int32_t step,
+                    uint8_t fractionBits) {
+  uint32_t mismatches = 0;
+  for (int32_t code = from; code <= to; code += step) {
+    Adafruit_MAX31856::formatTemperature(line, sizeof(line), code,
+                                         fractionBits, DECIMALS);
+    String reference((float)code / (1UL << fractionBits), DECIMALS);
+    if (!(reference == line) && !isTie(code, fractionBits)) {
+      if (mismatches++ < 10) {
+        Serial.print("  mismatch: ");
+        Serial.print(line);
+        Serial.print(" vs ");
+        Serial.println(reference);
+      }
+    }
+  }
+  return mismatches;
+}
+
+uint32_t checkLine(uint8_t len, bool json, const max31856_raw_t &raw,
+                   const char *expected) {
+  if (json)
+    Adafruit_MAX31856::formatJSON(line, len, &raw, 2);
+  else
+    Adafruit_MAX31856::formatCSV(line, len, &raw, 2);
+  if (strcmp(line, expected) == 0) return 0;
+  Serial.print("  mismatch: ");
+  Serial.print(line);
+  Serial.print(" vs ");
+  Serial.println(expected);
+  return 1;
+}
+
+void selfTest() {
+  Serial.println("Checking formatter against float printing...");
+  uint32_t mismatches = 0;
+  // thermocouple codes (1/128 C) and cold junction codes (1/256 C)
+  mismatches += checkRange(-210L * 128, 1800L * 128, 127, 7);
+  mismatches += checkRange(-55L * 256, 125L * 256, 61, 8);
+
+  max31856_raw_t negative = {-12345, -300, MAX31856_FAULT_OPEN, false};
+  max31856_raw_t room = {25 * 128, 25 * 256, 0, false};
+  mismatches += checkLine(sizeof(line), false, negative, "-96.45,-1.17,1");
+  mismatches += checkLine(sizeof(line), true, negative,
+                          "{\"tc\":-96.45,\"cj\":-1.17,\"fault\":1}");
+  mismatches += checkLine(sizeof(line), false, room, "25.00,25.00,0");
+  // too small a buffer gives an empty string, not a partial line
+  mismatches += checkLine(8, false, room, "");
+
+  Serial.print(mismatches ? "FAILED, mismatches: " : "Passed");
+  if (mismatches) Serial.println(mismatches);
+  else Serial.println();
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial) delay(10);
+  Serial.println("MAX31856 fast print test");
+
+  if (!maxthermo.begin()) {
+    Serial.println("Could not initialize thermocouple.");
+    while (1) delay(10);
+  }
+
+  maxthermo.setThermocoupleType(MAX31856_TCTYPE_K);
+
+#ifdef RUN_SELF_TEST
+  selfTest();
+#endif
+}
+
+void loop() {
+  max31856_raw_t raw;
+
+  if (maxthermo.readRaw(&raw)) {
+    uint32_t start = micros();
+    Adafruit_MAX31856::formatCSV(line, sizeof(line), &raw, DECIMALS);
+    uint32_t elapsed = micros() - start;
+    Serial.println(line);
+
+    Adafruit_MAX31856::formatJSON(line, sizeof(line), &raw, DECIMALS);
+    Serial.println(line);
+
+    Serial.print("Formatting took (us): ");
+    Serial.println(elapsed);
+  } else {
+    Serial.println("Conversion not complete!");
+  }
+
+  delay(1000);
+}
@@ -0,0 +1,195 @@
+// This example serves thermocouple readings to a Modbus RTU master
+// (a PLC, for example). The chips convert continuously and are read on
+// their own schedule into a per-channel cache, and Modbus requests are
+// answered straight from that cache. However fast the master polls, the
+// SPI bus and the chips only see the acquisition traffic.
+//
+// Supported functions: 0x03 (read holding registers) and 0x04 (read input
+// registers), which both return the same map. Each channel uses 8
+// registers starting at channel * 8:
+//   +0, +1  thermocouple, signed 32 bit in 1/128 degrees C (high word first)
+//   +2      cold junction, signed 16 bit in 1/256 degrees C
+//   +3      fault status register (MAX31856_FAULT_ flags)
+//   +4      quality: 0 = good, 1 = stale, 2 = failed (no chip answering,
+//           open thermocouple, over/under voltage or out of range)
+//   +5..+7  reserved, read as 0
+//
+// A single request may read the whole map (NUM_THERMO * 8 registers, up to
+// the Modbus limit of 125). A quantity of 0 or above that limit is answered
+// with exception 0x03, an address outside the map with exception 0x02.
+
+#include <Adafruit_MAX31856.h>
+
+#define MODBUS_SERIAL Serial
+#define MODBUS_BAUD 19200
+#define MODBUS_ADDRESS 1
+
+#define NUM_THERMO 2
+#define STALE_TIME 1000 // cache age before a sample is marked stale, ms
+
+#define MAP_SIZE (NUM_THERMO * 8) // registers in the map
+// most registers one request may read, Modbus allows at most 125
+#define MAX_COUNT (MAP_SIZE < 125 ? MAP_SIZE : 125)
+
+#define QUALITY_GOOD 0
+#define QUALITY_STALE 1
+#define QUALITY_FAILED 2
+
+// use hardware SPI, just pass in the CS pin of each chip
+Adafruit_MAX31856 maxthermo[NUM_THERMO] = {
+  Adafruit_MAX31856(10),
+  Adafruit_MAX31856(9),
+};
+
+// latest sample cache
+max31856_raw_t sample[NUM_THERMO];
+uint8_t quality[NUM_THERMO];
+uint32_t sampleTime[NUM_THERMO];
+
+uint16_t conversionTime;
+uint32_t lastRead = 0;
+
+// request frame being received
+uint8_t frame[32];
+uint8_t frameLen = 0;
+uint32_t lastByte = 0;
+uint32_t frameGap;
+
+uint16_t crc16(const uint8_t *buf, uint8_t len) {
+  uint16_t crc = 0xFFFF;
+  while (len--) {
+    crc ^= *buf++;
+    for (uint8_t i = 0; i < 8; i++) {
+      crc = (crc & 1) ? (crc >> 1) ^ 0xA001 : crc >> 1;
+    }
+  }
+  return crc;
+}
+
+void sendFrame(uint8_t *buf, uint8_t len) {
+  uint16_t crc = crc16(buf, len);
+  buf[len++] = crc & 0xFF;
+  buf[len++] = crc >> 8;
+  MODBUS_SERIAL.write(buf, len);
+}
+
+void sendException(uint8_t function, uint8_t code) {
+  uint8_t buf[5] = {MODBUS_ADDRESS, (uint8_t)(function | 0x80), code};
+  sendFrame(buf, 3);
+}
+
+uint16_t readRegister(uint16_t addr) {
+  uint8_t ch = addr / 8;
+  switch (addr % 8) {
+  case 0: return (uint32_t)sample[ch].thermocouple >> 16;
+  case 1: return sample[ch].thermocouple & 0xFFFF;
+  case 2: return sample[ch].cold_junction;
+  case 3: return sample[ch].fault;
+  case 4:
+    if (quality[ch] == QUALITY_GOOD && millis() - sampleTime[ch] > STALE_TIME)
+      return QUALITY_STALE;
+    return quality[ch];
+  default: return 0;
+  }
+}
+
+void handleFrame() {
+  // address, function, start (2), count (2), crc (2)
+  if (frameLen != 8 || frame[0] != MODBUS_ADDRESS) return;
+  if (crc16(frame, 6) != (frame[6] | ((uint16_t)frame[7] << 8))) return;
+
+  uint8_t function = frame[1];
+  if (function != 0x03 && function != 0x04) {
+    sendException(function, 0x01); // illegal function
+    return;
+  }
+
+  uint16_t start = ((uint16_t)frame[2] << 8) | frame[3];
+  uint16_t count = ((uint16_t)frame[4] << 8) | frame[5];
+  if (count == 0 || count > MAX_COUNT) {
+    sendException(function, 0x03); // illegal data value
+    return;
+  }
+  if (start >= MAP_SIZE || count > MAP_SIZE - start) {
+    sendException(function, 0x02); // illegal data address
+    return;
+  }
+
+  uint8_t buf[3 + MAX_COUNT * 2 + 2];
+  uint8_t len = 0;
+  buf[len++] = MODBUS_ADDRESS;
+  buf[len++] = function;
+  buf[len++] = count * 2;
+  for (uint16_t i = 0; i < count; i++) {
+    uint16_t value = readRegister(start + i);
+    buf[len++] = value >> 8;
+    buf[len++] = value & 0xFF;
+  }
+  sendFrame(buf, len);
+}
+
+// never blocks, a frame ends after 3.5 character times of silence
+void pollModbus() {
+  while (MODBUS_SERIAL.available()) {
+    uint8_t c = MODBUS_SERIAL.read();
+    if (frameLen < sizeof(frame)) frame[frameLen++] = c;
+    lastByte = micros();
+  }
+  if (frameLen && (micros() - lastByte > frameGap)) {
+    handleFrame();
+    frameLen = 0;
+  }
+}
+
+// faults that make the temperature meaningless
+#define BAD_FAULTS                                                             \
+  (MAX31856_FAULT_OPEN | MAX31856_FAULT_OVUV | MAX31856_FAULT_TCRANGE |       \
+   MAX31856_FAULT_CJRANGE)
+
+// a missing or dead chip reads back all zeros or all ones
+bool plausible(const uint8_t *registers) {
+  bool allZero = true, allOnes = true;
+  for (uint8_t i = 0; i < MAX31856_RAW_BYTES; i++) {
+    if (registers[i] != 0x00) allZero = false;
+    if (registers[i] != 0xFF) allOnes = false;
+  }
+  if (allZero || allOnes) return false;
+  return !(registers[MAX31856_RAW_BYTES - 1] & BAD_FAULTS);
+}
+
+void acquire() {
+  if (millis() - lastRead < conversionTime) return;
+  lastRead = millis();
+
+  for (int i = 0; i < NUM_THERMO; i++) {
+    uint8_t registers[MAX31856_RAW_BYTES];
+    if (maxthermo[i].readRaw(&sample[i], registers) &&
+        plausible(registers)) {
+      quality[i] = QUALITY_GOOD;
+      sampleTime[i] = lastRead;
+    } else {
+      quality[i] = QUALITY_FAILED;
+    }
+    // don't let the master wait on a full sweep
+    pollModbus();
+  }
+}
+
+void setup() {
+  MODBUS_SERIAL.begin(MODBUS_BAUD);
+  // the spec fixes the gap at 1750us above 19200 baud
+  frameGap = (MODBUS_BAUD > 19200) ? 1750 : 38500000UL / MODBUS_BAUD;
+
+  for (int i = 0; i < NUM_THERMO; i++) {
+    quality[i] = QUALITY_FAILED;
+    if (!maxthermo[i].begin()) continue;
+    maxthermo[i].setThermocoupleType(MAX31856_TCTYPE_K);
+    maxthermo[i].setConversionMode(MAX31856_CONTINUOUS);
+  }
+  conversionTime = maxthermo[0].getConversionTime();
+}
+
+void loop() {
+  acquire();
+  pollModbus();
+}
@@ -0,0 +1,77 @@
+// This example demonstrates reading several MAX31856 chips together.
+// Each chip runs its own conversion, so instead of a blocking read per
+// chip all of them are triggered first and then read back in one pass.
+// A full sweep takes about one conversion time no matter how many chips
+// are attached, and chips may be spread across several SPI buses.
+
+#include <Adafruit_MAX31856.h>
+
+#define NUM_THERMO 4
+
+uint16_t timeout; // longest conversion plus some margin, ms
+
+// use hardware SPI, just pass in the CS pin of each chip
+Adafruit_MAX31856 maxthermo[NUM_THERMO] = {
+  Adafruit_MAX31856(10),
+  Adafruit_MAX31856(9),
+  Adafruit_MAX31856(8),
+  Adafruit_MAX31856(7),
+  // on boards with more than one SPI bus, pass in the bus to use
+  //Adafruit_MAX31856(6, &SPI1),
+};
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial) delay(10);
+  Serial.println("MAX31856 multiple thermocouple test");
+
+  for (int i = 0; i < NUM_THERMO; i++) {
+    if (!maxthermo[i].begin()) {
+      Serial.print("Could not initialize thermocouple #");
+      Serial.println(i);
+      while (1) delay(10);
+    }
+    maxthermo[i].setThermocoupleType(MAX31856_TCTYPE_K);
+    maxthermo[i].setConversionMode(MAX31856_ONESHOT_NOWAIT);
+  }
+
+  // all chips share the same settings, so one conversion time covers them
+  timeout = maxthermo[0].getConversionTime() + 100;
+}
+
+void loop() {
+  // start a conversion on every chip, these return immediately
+  for (int i = 0; i < NUM_THERMO; i++) {
+    maxthermo[i].triggerOneShot();
+  }
+
+  // all chips are now converting at the same time, wait for them
+  bool done[NUM_THERMO] = {false};
+  int remaining = NUM_THERMO;
+  uint32_t start = millis();
+  while (remaining && (millis() - start < timeout)) {
+    delay(10); // don't keep the buses busy while waiting
+    for (int i = 0; i < NUM_THERMO; i++) {
+      if (!done[i] && maxthermo[i].conversionComplete()) {
+        done[i] = true;
+        remaining--;
+      }
+    }
+  }
+
+  // and read them all back
+  for (int i = 0; i < NUM_THERMO; i++) {
+    Serial.print("Thermocouple #");
+    Serial.print(i);
+    Serial.print(": ");
+    if (done[i]) {
+      Serial.println(maxthermo[i].readThermocoupleTemperature());
+    } else {
+      Serial.println("Conversion not complete!");
+    }
+  }
+  Serial.print("Sweep time (ms): ");
+  Serial.println(millis() - start);
+
+  delay(1000);
+}
@@ -0,0 +1,218 @@
+// This example replays raw captures recorded with the max31856_capture
+// example through the library's decode and a table of candidate
+// processing settings, so production settings can be picked from real
+// field data instead of by trials on the plant. No chip is needed, paste
+// or send the captured lines, for example:
+//
+//   12345,19A0007D4000
+//
+// Lines starting with # are ignored. Send a line reading "end" to print
+// the report for every candidate and start over.
+//
+// Each candidate averages 'depth' readings into one output (averaging and
+// decimation), only sends an output when it moved more than 'deadband'
+// from the last value sent (compression), and raises an alarm when the
+// sent value rises above 'alarm'. The report lists per candidate:
+//
+//   out    outputs after averaging and decimation
+//   sent   outputs actually sent after compression, the data volume
+//   noise  RMS of output to output changes / sqrt(2), in degrees C
+//   error  RMS of each reading minus the value last sent, in degrees C
+//   alarms number of times the sent value crossed above the alarm limit
+//
+// Candidates are evaluated one reading at a time with fixed memory, so
+// captures of any length can be replayed.
+
+#include <Adafruit_MAX31856.h>
+
+struct Candidate {
+  uint8_t depth;     // readings averaged per output
+  uint16_t deadband; // minimum change to send, 1/128 degrees C
+  int32_t alarm;     // alarm limit, 1/128 degrees C
+};
+
+// edit this table to try other settings
+const Candidate candidates[] = {
+  {1, 0, 100 * 128L},
+  {1, 64, 100 * 128L},
+  {4, 0, 100 * 128L},
+  {4, 32, 100 * 128L},
+  {16, 0, 100 * 128L},
+  {16, 16, 100 * 128L},
+};
+
+#define NUM_CANDIDATES (sizeof(candidates) / sizeof(candidates[0]))
+
+struct Result {
+  int32_t sum;      // of the readings in the current block
+  uint8_t count;    // readings in the current block
+  int32_t lastOut;  // previous output, for noise
+  int32_t lastSent; // value the receiver currently holds
+  bool alarmed;
+  uint32_t outputs;
+  uint32_t sent;
+  uint32_t alarms;
+  uint32_t tracked; // readings compared against a sent value
+  float noiseSq;
+  float errorSq;
+};
+
+Result results[NUM_CANDIDATES];
+uint32_t readings, faults, firstMillis, lastMillis;
+
+char line[32];
+uint8_t lineLen = 0;
+
+void reset() {
+  memset(results, 0, sizeof(results));
+  readings = faults = 0;
+}
+
+void replay(int32_t temp) {
+  for (uint8_t c = 0; c < NUM_CANDIDATES; c++) {
+    const Candidate &cand = candidates[c];
+    Result &res = results[c];
+
+    res.sum += temp;
+    if (++res.count == cand.depth) {
+      // block complete, this is one output
+      int32_t out = res.sum / res.count;
+      res.sum = 0;
+      res.count = 0;
+      if (res.outputs) {
+        float diff = out - res.lastOut;
+        res.noiseSq += diff * diff;
+      }
+      res.lastOut = out;
+      res.outputs++;
+
+      if (!res.sent || labs(out - res.lastSent) > (int32_t)cand.deadband) {
+        res.lastSent = out;
+        res.sent++;
+
+        bool above = out > cand.alarm;
+        if (above && !res.alarmed)
+          res.alarms++;
+        res.alarmed = above;
+      }
+    }
+
+    // compare against what the receiver holds once this reading is in
+    if (res.sent) {
+      float err = temp - res.lastSent;
+      res.errorSq += err * err;
+      res.tracked++;
+    }
+  }
+}
+
+void report() {
+  Serial.print("# readings: ");
+  Serial.print(readings);
+  Serial.print(", faulted: ");
+  Serial.print(faults);
+  if (readings) {
+    Serial.print(", seconds: ");
+    Serial.print((lastMillis - firstMillis) / 1000.0, 1);
+  }
+  Serial.println();
+  Serial.println("depth,deadband,alarm,out,sent,noise,error,alarms");
+
+  for (uint8_t c = 0; c < NUM_CANDIDATES; c++) {
+    const Candidate &cand = candidates[c];
+    const Result &res = results[c];
+    Serial.print(cand.depth);
+    Serial.print(',');
+    Serial.print(cand.deadband / 128.0, 3);
+    Serial.print(',');
+    Serial.print(cand.alarm / 128.0, 1);
+    Serial.print(',');
+    Serial.print(res.outputs);
+    Serial.print(',');
+    Serial.print(res.sent);
+    Serial.print(',');
+    Serial.print(res.outputs > 1
+                     ? sqrt(res.noiseSq / (res.outputs - 1) / 2) / 128
+                     : 0.0,
+                 4);
+    Serial.print(',');
+    Serial.print(res.tracked ? sqrt(res.errorSq / res.tracked) / 128 : 0.0,
+                 4);
+    Serial.print(',');
+    Serial.println(res.alarms);
+  }
+}
+
+int8_t hexDigit(char c) {
+  if (c >= '0' && c <= '9')
+    return c - '0';
+  if (c >= 'A' && c <= 'F')
+    return c - 'A' + 10;
+  if (c >= 'a' && c <= 'f')
+    return c - 'a' + 10;
+  return -1;
+}
+
+// parse "millis,HEX12" as written by max31856_capture
+void handleLine() {
+  if (line[0] == '#')
+    return;
+  if (!strcmp(line, "end")) {
+    report();
+    reset();
+    return;
+  }
+
+  char *hex = strchr(line, ',');
+  if (!hex || strlen(hex + 1) != 2 * MAX31856_RAW_BYTES) {
+    Serial.println("# bad line");
+    return;
+  }
+  uint8_t registers[MAX31856_RAW_BYTES];
+  for (uint8_t i = 0; i < MAX31856_RAW_BYTES; i++) {
+    int8_t hi = hexDigit(hex[1 + 2 * i]);
+    int8_t lo = hexDigit(hex[2 + 2 * i]);
+    if (hi < 0 || lo < 0) {
+      Serial.println("# bad line");
+      return;
+    }
+    registers[i] = (hi << 4) | lo;
+  }
+
+  uint32_t now = strtoul(line, NULL, 10);
+  if (!readings)
+    firstMillis = now;
+  lastMillis = now;
+  readings++;
+
+  // same decode as a live readRaw()
+  max31856_raw_t raw;
+  Adafruit_MAX31856::decodeRaw(registers, &raw);
+  if (raw.fault) {
+    faults++; // a faulted reading is not a temperature
+    return;
+  }
+  replay(raw.thermocouple);
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial) delay(10);
+  Serial.println("# MAX31856 capture replay, send capture lines then \"end\"");
+  reset();
+}
+
+void loop() {
+  while (Serial.available()) {
+    char c = Serial.read();
+    if (c == '\n' || c == '\r') {
+      if (lineLen) {
+        line[lineLen] = 0;
+        handleLine();
+        lineLen = 0;
+      }
+    } else if (lineLen < sizeof(line) - 1) {
+      line[lineLen++] = c;
+    }
+  }
+}
@@ -0,0 +1,179 @@
+// This example reads many chips on a shared SPI bus and keeps the
+// important ones on time when the bus can't keep up. Each channel has a
+// priority and a slowest acceptable read period. The time spent in SPI
+// transactions is measured, and when the bus is busier than BUS_BUDGET
+// the lowest priority channels are read less often (and, if that is not
+// enough, skipped) first. What was dropped is reported once a second.
+
+#include <Adafruit_MAX31856.h>
+
+#define NUM_THERMO 4
+#define BUS_BUDGET 50   // percent of time we allow on the SPI bus
+#define REPORT_INTERVAL 1000
+
+struct Channel {
+  Adafruit_MAX31856 thermo;
+  uint8_t priority;      // higher is more important
+  uint16_t maxPeriod;    // slowest acceptable read period, ms
+  uint16_t period;       // current read period, ms
+  uint32_t nextRead;     // millis() when next due
+  bool shed;             // not being read at all
+  uint32_t reads;        // reads in this report interval
+  uint32_t dropped;      // scheduled reads skipped in this report interval
+  max31856_raw_t sample; // latest reading
+};
+
+// everything after the slowest period starts out zero, setup() fills it in
+#define CHANNEL_STATE 0, 0, false, 0, 0, {0, 0, 0, false}
+
+// use hardware SPI, pass in the CS pin of each chip with its priority and
+// slowest acceptable period
+Channel channels[NUM_THERMO] = {
+  {Adafruit_MAX31856(10), 3, 100, CHANNEL_STATE}, // control loop, full rate
+  {Adafruit_MAX31856(9), 2, 500, CHANNEL_STATE},
+  {Adafruit_MAX31856(8), 1, 2000, CHANNEL_STATE},
+  {Adafruit_MAX31856(7), 0, 5000, CHANNEL_STATE}, // logging only
+};
+
+uint16_t conversionTime;
+uint32_t busyTime = 0;    // us spent in transactions this window
+uint32_t windowStart = 0; // us
+uint32_t lastReport = 0;
+
+// channels sorted by priority, most important first
+Channel *order[NUM_THERMO];
+
+// slow down, or stop reading, the least important channel still running
+void shedLoad() {
+  for (int i = NUM_THERMO - 1; i >= 0; i--) {
+    Channel *c = order[i];
+    if (c->shed) continue;
+    if (c->period * 2 <= c->maxPeriod) {
+      c->period *= 2; // decimate
+    } else if (i > 0) {
+      c->shed = true; // can't go slower and still be useful, drop it
+    } else {
+      continue; // never drop the most important channel
+    }
+    return;
+  }
+}
+
+// give back rate to the most important channel that lost some
+void restoreLoad() {
+  for (int i = 0; i < NUM_THERMO; i++) {
+    Channel *c = order[i];
+    if (c->shed) {
+      c->shed = false;
+      c->nextRead = millis();
+      return;
+    }
+    if (c->period > conversionTime) {
+      c->period /= 2;
+      if (c->period < conversionTime) c->period = conversionTime;
+      return;
+    }
+  }
+}
+
+void report() {
+  for (int i = 0; i < NUM_THERMO; i++) {
+    Channel &c = channels[i];
+    Serial.print("#");
+    Serial.print(i);
+    Serial.print(" prio ");
+    Serial.print(c.priority);
+    Serial.print(c.shed ? " SHED" : " period ");
+    if (!c.shed) Serial.print(c.period);
+    Serial.print(" reads ");
+    Serial.print(c.reads);
+    Serial.print(" dropped ");
+    Serial.print(c.dropped);
+    Serial.print(" temp ");
+    Serial.println(c.sample.thermocouple / 128.0);
+    c.reads = c.dropped = 0;
+  }
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial) delay(10);
+  Serial.println("MAX31856 priority scheduler test");
+
+  for (int i = 0; i < NUM_THERMO; i++) {
+    Channel &c = channels[i];
+    if (!c.thermo.begin()) {
+      Serial.print("Could not initialize thermocouple #");
+      Serial.println(i);
+      while (1) delay(10);
+    }
+    c.thermo.setThermocoupleType(MAX31856_TCTYPE_K);
+    c.thermo.setConversionMode(MAX31856_CONTINUOUS);
+  }
+
+  // no point reading faster than the chips convert
+  conversionTime = channels[0].thermo.getConversionTime();
+  for (int i = 0; i < NUM_THERMO; i++) {
+    // first read is due now, not counted as late from boot
+    channels[i].nextRead = millis();
+    channels[i].period = conversionTime;
+    if (channels[i].maxPeriod < conversionTime)
+      channels[i].maxPeriod = conversionTime;
+  }
+
+  for (int i = 0; i < NUM_THERMO; i++) {
+    int j = i;
+    while (j > 0 && order[j - 1]->priority < channels[i].priority) {
+      order[j] = order[j - 1];
+      j--;
+    }
+    order[j] = &channels[i];
+  }
+
+  windowStart = micros();
+}
+
+void loop() {
+  uint32_t now = millis();
+
+  // highest priority first, so they get the bus when it is contended
+  for (int i = 0; i < NUM_THERMO; i++) {
+    Channel &c = *order[i];
+    if ((int32_t)(now - c.nextRead) < 0) continue;
+
+    if (c.shed) {
+      c.dropped++;
+      c.nextRead = now + conversionTime;
+      continue;
+    }
+
+    // reads we fell behind on, or skipped through decimation
+    uint32_t late = (now - c.nextRead) / c.period;
+    c.dropped += late + c.period / conversionTime - 1;
+
+    uint32_t start = micros();
+    c.thermo.readRaw(&c.sample);
+    busyTime += micros() - start;
+
+    c.reads++;
+    c.nextRead += (late + 1) * c.period;
+  }
+
+  // bus utilization over the last 100ms
+  uint32_t window = micros() - windowStart;
+  if (window > 100000UL) {
+    uint32_t utilization = busyTime / (window / 100);
+    if (utilization > BUS_BUDGET) {
+      shedLoad();
+    } else if (utilization < BUS_BUDGET / 2) {
+      restoreLoad();
+    }
+    busyTime = 0;
+    windowStart = micros();
+  }
+
+  if (now - lastReport > REPORT_INTERVAL) {
+    lastReport = now;
+    report();
+  }
+}
@@ -0,0 +1,55 @@
+// This example changes settings during continuous conversion without
+// corrupting a reading. New settings are staged, and the library writes
+// them in one burst right after the next completed read. The first
+// sample taken with the new settings is marked as reconfigured.
+
+#include <Adafruit_MAX31856.h>
+
+#define DRDY_PIN 5
+
+// Use software SPI: CS, DI, DO, CLK
+//Adafruit_MAX31856 maxthermo = Adafruit_MAX31856(10, 11, 12, 13);
+// use hardware SPI, just pass in the CS pin
+Adafruit_MAX31856 maxthermo = Adafruit_MAX31856(10);
+
+uint32_t lastChange = 0;
+bool averaging = false;
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial) delay(10);
+  Serial.println("MAX31856 staged configuration test");
+
+  pinMode(DRDY_PIN, INPUT);
+
+  if (!maxthermo.begin()) {
+    Serial.println("Could not initialize thermocouple.");
+    while (1) delay(10);
+  }
+
+  maxthermo.setThermocoupleType(MAX31856_TCTYPE_K);
+  maxthermo.setConversionMode(MAX31856_CONTINUOUS);
+}
+
+void loop() {
+  // every 5 seconds, toggle between 1 and 4 sample averaging
+  if (millis() - lastChange > 5000) {
+    lastChange = millis();
+    averaging = !averaging;
+    maxthermo.stageAveragingMode(averaging ? MAX31856_AVERAGE_4
+                                           : MAX31856_AVERAGE_1);
+    // nothing is written yet, conversion carries on undisturbed
+  }
+
+  // The DRDY output goes low when a new conversion result is available
+  while (digitalRead(DRDY_PIN)) delay(1);
+
+  max31856_raw_t raw;
+  maxthermo.readRaw(&raw); // staged settings are applied after this read
+  if (raw.reconfigured) {
+    Serial.print("--- now averaging ");
+    Serial.print(averaging ? 4 : 1);
+    Serial.println(" samples ---");
+  }
+  Serial.println(raw.thermocouple / 128.0);
+}
@@ -0,0 +1,139 @@
+// This example uses the chip's own fault comparator as a thermal-runaway
+// cut-off. The high temperature threshold is set to the hard limit, and
+// only over-temperature and open thermocouple faults may assert the FAULT
+// pin. The FAULT pin is wired to an interrupt that turns the heater off
+// right away, so the response does not depend on how busy loop() is.
+// The whole configuration, including the conversion mode and open circuit
+// detection the comparator depends on, is checked every second in case
+// the chip was reset or corrupted.
+
+#include <Adafruit_MAX31856.h>
+
+#define FAULT_PIN 2   // must be an interrupt capable pin
+#define HEATER_PIN 6  // heater output, HIGH = on
+#define TEMP_LIMIT 250.0 // hard cut-off, degrees C
+#define TEMP_LOW -50.0   // low fault threshold, degrees C
+
+// faults allowed to assert the FAULT pin, all others are masked
+#define FAULT_ENABLE (MAX31856_FAULT_TCHIGH | MAX31856_FAULT_OPEN)
+
+// Use software SPI: CS, DI, DO, CLK
+//Adafruit_MAX31856 maxthermo = Adafruit_MAX31856(10, 11, 12, 13);
+// use hardware SPI, just pass in the CS pin
+Adafruit_MAX31856 maxthermo = Adafruit_MAX31856(10);
+
+volatile bool tripped = false;
+
+// Keep this as short as possible. On cores that support it, give this
+// interrupt the highest priority so nothing can delay the cut-off.
+void faultISR() {
+  digitalWrite(HEATER_PIN, LOW);
+  tripped = true;
+}
+
+// turn the heater on, unless the FAULT pin is already asserted
+void arm() {
+  noInterrupts();
+  if (digitalRead(FAULT_PIN) == LOW) {
+    faultISR();
+  } else if (!tripped) {
+    digitalWrite(HEATER_PIN, HIGH);
+  }
+  interrupts();
+}
+
+// write every register configOK() checks, so a chip that was reset or
+// corrupted is fully restored
+bool configure() {
+  // begin() restores CR0, including open circuit detection
+  if (!maxthermo.begin())
+    return false;
+  maxthermo.setThermocoupleType(MAX31856_TCTYPE_K);
+  maxthermo.setAveragingMode(MAX31856_AVERAGE_1);
+  maxthermo.setNoiseFilter(MAX31856_NOISE_FILTER_60HZ);
+  maxthermo.setTempFaultThreshholds(TEMP_LOW, TEMP_LIMIT);
+  maxthermo.setColdJunctionFaultThreshholds(-64, 127); // chip defaults
+  maxthermo.setFaultMask((uint8_t)~FAULT_ENABLE);
+  // latch the fault so a brief excursion still keeps the heater off
+  maxthermo.setFaultMode(MAX31856_FAULTMODE_INTERRUPT);
+  // convert continuously so the comparator runs on its own
+  maxthermo.setConversionMode(MAX31856_CONTINUOUS);
+  return true;
+}
+
+// thresholds as stored in the chip, 1/16 degree steps
+#define HIGH_CODE ((int16_t)(TEMP_LIMIT * 16))
+#define LOW_CODE ((int16_t)(TEMP_LOW * 16))
+
+// CR0 through LTLFTL as configure() leaves them. Without auto-convert the
+// comparator stops, and without open circuit detection OPEN never sets,
+// so those bits matter as much as the thresholds.
+const uint8_t expected[MAX31856_LTLFTL_REG + 1] = {
+  // CR0: continuous, open circuit detection, latched faults, 60Hz filter
+  MAX31856_CR0_AUTOCONVERT | MAX31856_CR0_OCFAULT0 | MAX31856_CR0_FAULT,
+  // CR1: no averaging, type K
+  (MAX31856_AVERAGE_1 << 4) | MAX31856_TCTYPE_K,
+  (uint8_t)~FAULT_ENABLE,    // MASK
+  (uint8_t)127,              // CJHF
+  (uint8_t)-64,              // CJLF
+  (uint8_t)(HIGH_CODE >> 8), // LTHFTH
+  (uint8_t)HIGH_CODE,        // LTHFTL
+  (uint8_t)(LOW_CODE >> 8),  // LTLFTH
+  (uint8_t)LOW_CODE,         // LTLFTL
+};
+
+bool configOK() {
+  uint8_t regs[MAX31856_REG_COUNT];
+  maxthermo.dumpRegisters(regs);
+  regs[MAX31856_CR0_REG] &= ~MAX31856_CR0_FAULTCLR; // self clearing
+  return memcmp(regs, expected, sizeof(expected)) == 0;
+}
+
+void setup() {
+  // heater stays off until the supervisor is armed
+  pinMode(HEATER_PIN, OUTPUT);
+  digitalWrite(HEATER_PIN, LOW);
+  pinMode(FAULT_PIN, INPUT_PULLUP); // FAULT is open drain, active low
+
+  Serial.begin(115200);
+  while (!Serial) delay(10);
+  Serial.println("MAX31856 thermal runaway supervisor");
+
+  if (!configure()) {
+    Serial.println("Could not initialize thermocouple.");
+    while (1) delay(10);
+  }
+  maxthermo.clearFault();
+
+  attachInterrupt(digitalPinToInterrupt(FAULT_PIN), faultISR, FALLING);
+
+  if (configOK()) {
+    arm();
+  } else {
+    Serial.println("Configuration did not verify, heater stays off");
+  }
+}
+
+void loop() {
+  if (tripped) {
+    uint8_t fault = maxthermo.readFault();
+    Serial.print("Heater off! Fault: 0x");
+    Serial.println(fault, HEX);
+    if (fault & MAX31856_FAULT_TCHIGH) Serial.println("Thermocouple High Fault");
+    if (fault & MAX31856_FAULT_OPEN)   Serial.println("Thermocouple Open Fault");
+    // stay off until the board is reset
+    while (1) delay(10);
+  }
+
+  if (!configOK()) {
+    digitalWrite(HEATER_PIN, LOW);
+    Serial.println("Configuration changed, reconfiguring");
+    configure();
+    if (configOK()) arm();
+    return;
+  }
+
+  Serial.print("Thermocouple Temp: ");
+  Serial.println(maxthermo.readThermocoupleTemperature());
+  delay(1000);
+}
@@ -0,0 +1,173 @@
+// This example is a serial console for checking MAX31856 chips in the
+// field, without a logic analyzer. Send a single letter command:
+//
+//   p  probe each chip slot and report whether a chip answers
+//   d  dump all registers of each chip
+//   c  stream samples as CSV (send any key to stop)
+//   b  stream samples as binary: 0xA5 0x5A, chip number, 6 register bytes
+//   s  stream bus statistics once a second: transactions/s, bytes/s,
+//      bus utilization, worst case DRDY to read latency and missed DRDY
+//      count
+//
+// Chips run in continuous mode, each read waits for that chip's DRDY pin.
+
+#include <Adafruit_MAX31856.h>
+
+#define NUM_THERMO 2
+#define READ_BYTES (1 + MAX31856_RAW_BYTES) // address byte + data
+
+// use hardware SPI, just pass in the CS pin of each chip
+Adafruit_MAX31856 maxthermo[NUM_THERMO] = {
+  Adafruit_MAX31856(10),
+  Adafruit_MAX31856(9),
+};
+const uint8_t drdyPins[NUM_THERMO] = {5, 6};
+
+uint16_t conversionTime;
+char mode = 0;
+
+// statistics for the current one second window
+uint32_t statStart;
+uint32_t transactions;
+uint32_t busyTime;    // us spent in SPI transactions
+uint32_t latencyMax;  // longest DRDY to read latency, us
+uint32_t latencySum;
+uint32_t missed;      // conversions we never read
+uint32_t drdyHigh[NUM_THERMO]; // micros() when DRDY was last seen high
+uint32_t lastRead[NUM_THERMO]; // millis() of the previous read
+
+void resetStats() {
+  statStart = millis();
+  transactions = busyTime = latencyMax = latencySum = missed = 0;
+}
+
+void probe() {
+  uint8_t regs[MAX31856_REG_COUNT];
+  for (int i = 0; i < NUM_THERMO; i++) {
+    maxthermo[i].dumpRegisters(regs);
+    // an empty slot reads back all zeros or all ones
+    bool allSame = true;
+    for (uint8_t r = 1; r < MAX31856_REG_COUNT; r++) {
+      if (regs[r] != regs[0]) allSame = false;
+    }
+    Serial.print("Chip #");
+    Serial.print(i);
+    Serial.println((allSame && (regs[0] == 0x00 || regs[0] == 0xFF))
+                       ? ": not found"
+                       : ": responding");
+  }
+}
+
+void dump() {
+  uint8_t regs[MAX31856_REG_COUNT];
+  for (int i = 0; i < NUM_THERMO; i++) {
+    maxthermo[i].dumpRegisters(regs);
+    Serial.print("Chip #");
+    Serial.print(i);
+    Serial.print(":");
+    for (uint8_t r = 0; r < MAX31856_REG_COUNT; r++) {
+      Serial.print(regs[r] < 0x10 ? " 0" : " ");
+      Serial.print(regs[r], HEX);
+    }
+    Serial.println();
+  }
+}
+
+void printStats() {
+  uint32_t elapsed = millis() - statStart;
+  if (!elapsed) return;
+  Serial.print("trans/s ");
+  Serial.print(transactions * 1000 / elapsed);
+  Serial.print("  bytes/s ");
+  Serial.print(transactions * READ_BYTES * 1000 / elapsed);
+  Serial.print("  util% ");
+  Serial.print(busyTime / 10 / elapsed);
+  Serial.print("  latency us avg ");
+  Serial.print(transactions ? latencySum / transactions : 0);
+  Serial.print(" max ");
+  Serial.print(latencyMax);
+  Serial.print("  missed DRDY ");
+  Serial.println(missed);
+}
+
+// read any chip with a new conversion ready
+void acquire() {
+  for (int i = 0; i < NUM_THERMO; i++) {
+    uint32_t now = micros();
+    if (digitalRead(drdyPins[i])) {
+      drdyHigh[i] = now;
+      continue;
+    }
+
+    max31856_raw_t raw;
+    uint8_t regs[MAX31856_RAW_BYTES];
+    maxthermo[i].readRaw(&raw, regs);
+    uint32_t done = micros();
+
+    transactions++;
+    busyTime += done - now;
+    // DRDY fell some time after it was last seen high, so this is the
+    // worst case latency
+    uint32_t latency = done - drdyHigh[i];
+    latencySum += latency;
+    if (latency > latencyMax) latencyMax = latency;
+
+    // more than one conversion time since the last read means we missed some
+    uint32_t gap = millis() - lastRead[i];
+    if (lastRead[i] && gap > conversionTime * 3 / 2)
+      missed += gap / conversionTime - 1;
+    lastRead[i] = millis();
+
+    if (mode == 'c') {
+      char line[32];
+      Serial.print(i);
+      Serial.print(',');
+      Adafruit_MAX31856::formatCSV(line, sizeof(line), &raw);
+      Serial.println(line);
+    } else if (mode == 'b') {
+      Serial.write(0xA5);
+      Serial.write(0x5A);
+      Serial.write((uint8_t)i);
+      Serial.write(regs, MAX31856_RAW_BYTES);
+    }
+  }
+}
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial) delay(10);
+  Serial.println("MAX31856 tool, commands: p d c b s");
+
+  for (int i = 0; i < NUM_THERMO; i++) {
+    pinMode(drdyPins[i], INPUT);
+    maxthermo[i].begin();
+    maxthermo[i].setConversionMode(MAX31856_CONTINUOUS);
+    // conversions start now, so the first latency is measured from here
+    drdyHigh[i] = micros();
+  }
+  conversionTime = maxthermo[0].getConversionTime();
+  resetStats();
+}
+
+void loop() {
+  if (Serial.available()) {
+    char c = Serial.read();
+    if (mode) {
+      mode = 0; // any key stops streaming
+    } else if (c == 'p') {
+      probe();
+    } else if (c == 'd') {
+      dump();
+    } else if (c == 'c' || c == 'b' || c == 's') {
+      mode = c;
+      resetStats();
+    }
+  }
+
+  acquire();
+
+  if (mode == 's' && millis() - statStart >= 1000) {
+    printStats();
+    resetStats();
+  }
+}
@@ -0,0 +1,47 @@
+// This example reads the MAX31856 through the Adafruit Unified Sensor
+// interface. getEvent() fills both the thermocouple and cold junction
+// events from a single conversion and burst read.
+
+#include <Adafruit_MAX31856.h>
+
+// Use software SPI: CS, DI, DO, CLK
+//Adafruit_MAX31856 maxthermo = Adafruit_MAX31856(10, 11, 12, 13);
+// use hardware SPI, just pass in the CS pin
+Adafruit_MAX31856 maxthermo = Adafruit_MAX31856(10);
+
+Adafruit_Sensor *thermocouple_sensor = maxthermo.getThermocoupleSensor();
+
+void setup() {
+  Serial.begin(115200);
+  while (!Serial) delay(10);
+  Serial.println("MAX31856 unified sensor test");
+
+  if (!maxthermo.begin()) {
+    Serial.println("Could not initialize thermocouple.");
+    while (1) delay(10);
+  }
+
+  maxthermo.setThermocoupleType(MAX31856_TCTYPE_K);
+
+  sensor_t sensor;
+  thermocouple_sensor->getSensor(&sensor);
+  Serial.print("Sensor: ");
+  Serial.println(sensor.name);
+  Serial.print("Resolution: ");
+  Serial.println(sensor.resolution, 7);
+}
+
+void loop() {
+  sensors_event_t thermocouple, cold_junction;
+
+  if (maxthermo.getEvent(&thermocouple, &cold_junction)) {
+    Serial.print("Cold Junction Temp: ");
+    Serial.println(cold_junction.temperature);
+    Serial.print("Thermocouple Temp: ");
+    Serial.println(thermocouple.temperature);
+  } else {
+    Serial.println("Conversion not complete!");
+  }
+
+  delay(1000);
+}